@@ -0,0 +1,224 @@
+#include <cmath>
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+
+#include "background-load.h"
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("LltBackgroundLoad");
+
+NS_OBJECT_ENSURE_REGISTERED (BackgroundLoadSender);
+
+TypeId
+BackgroundLoadSender::GetTypeId (void)
+{
+  static TypeId tid =
+      TypeId ("BackgroundLoadSender")
+          .SetParent<Application> ()
+          .AddConstructor<BackgroundLoadSender> ()
+          .AddAttribute ("Mode", "How the offered load is generated.",
+                         EnumValue (BackgroundLoadSender::OCCUPANCY),
+                         MakeEnumAccessor (&BackgroundLoadSender::m_mode),
+                         MakeEnumChecker (BackgroundLoadSender::RATE, "Rate",
+                                          BackgroundLoadSender::POISSON, "Poisson",
+                                          BackgroundLoadSender::OCCUPANCY, "Occupancy"))
+          .AddAttribute ("PacketSize", "The size of packets transmitted.", UintegerValue (1400),
+                         MakeUintegerAccessor (&BackgroundLoadSender::m_pktSize),
+                         MakeUintegerChecker<uint32_t> (1))
+          .AddAttribute ("Destination", "Target host address.",
+                         Ipv4AddressValue ("255.255.255.255"),
+                         MakeIpv4AddressAccessor (&BackgroundLoadSender::m_destAddr),
+                         MakeIpv4AddressChecker ())
+          .AddAttribute ("Port", "Destination app port.", UintegerValue (5687),
+                         MakeUintegerAccessor (&BackgroundLoadSender::m_destPort),
+                         MakeUintegerChecker<uint32_t> ())
+          .AddAttribute ("DataRate", "Offered load in Rate and Poisson mode.",
+                         DataRateValue (DataRate ("4Mbps")),
+                         MakeDataRateAccessor (&BackgroundLoadSender::m_rate),
+                         MakeDataRateChecker ())
+          .AddAttribute ("Interval",
+                         "Time between bursts (mean time between bursts in Poisson mode)",
+                         TimeValue (MilliSeconds (10)),
+                         MakeTimeAccessor (&BackgroundLoadSender::m_interval), MakeTimeChecker ())
+          .AddAttribute ("TargetOccupancy",
+                         "Bytes kept outstanding towards the sink in Occupancy mode.  Keep it "
+                         "below the eNB RLC buffer size, so that the buffer does not overflow.",
+                         UintegerValue (8000),
+                         MakeUintegerAccessor (&BackgroundLoadSender::m_target),
+                         MakeUintegerChecker<uint32_t> ())
+          .AddAttribute ("StallTimeout",
+                         "In Occupancy mode, bytes still outstanding after the sink has not "
+                         "received anything for this long are considered lost.",
+                         TimeValue (MilliSeconds (200)),
+                         MakeTimeAccessor (&BackgroundLoadSender::m_stallTimeout),
+                         MakeTimeChecker ())
+          .AddTraceSource ("Tx", "A new packet is created and is sent",
+                           MakeTraceSourceAccessor (&BackgroundLoadSender::m_txTrace),
+                           "ns3::Packet::TracedCallback");
+  return tid;
+}
+
+BackgroundLoadSender::BackgroundLoadSender ()
+    : m_sink (nullptr), m_txBytes (0), m_lastRx (0), m_residual (0)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  m_socket = 0;
+  m_burstGap = CreateObject<ExponentialRandomVariable> ();
+}
+
+BackgroundLoadSender::~BackgroundLoadSender ()
+{
+  NS_LOG_FUNCTION_NOARGS ();
+}
+
+void
+BackgroundLoadSender::DoDispose (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  m_socket = 0;
+  m_sink = 0;
+  Application::DoDispose ();
+}
+
+void
+BackgroundLoadSender::SetSink (Ptr<PacketSink> sink)
+{
+  m_sink = sink;
+}
+
+void
+BackgroundLoadSender::StartApplication ()
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  if (m_mode == OCCUPANCY && m_sink == nullptr)
+    {
+      NS_FATAL_ERROR ("Occupancy mode needs a sink to compute the outstanding bytes");
+    }
+  if (!m_interval.IsStrictlyPositive ())
+    {
+      NS_FATAL_ERROR ("Interval must be positive, got " << m_interval);
+    }
+  if (m_mode == OCCUPANCY && !m_stallTimeout.IsStrictlyPositive ())
+    {
+      NS_FATAL_ERROR ("StallTimeout must be positive, got " << m_stallTimeout);
+    }
+
+  if (m_socket == 0)
+    {
+      TypeId tid = TypeId::LookupByName ("ns3::UdpSocketFactory");
+      m_socket = Socket::CreateSocket (GetNode (), tid);
+
+      if (m_socket->Bind () == -1)
+        {
+          NS_FATAL_ERROR ("Failed to bind socket");
+        }
+      m_socket->Connect (InetSocketAddress (m_destAddr, m_destPort));
+    }
+
+  m_burstGap->SetAttribute ("Mean", DoubleValue (m_interval.GetSeconds ()));
+  // Outstanding bytes are counted from whatever the sink has got so far
+  m_txBytes = m_sink != nullptr ? m_sink->GetTotalRx () : 0;
+  m_lastRx = m_txBytes;
+  m_lastProgress = Simulator::Now ();
+  m_residual = 0;
+
+  Simulator::Cancel (m_sendEvent);
+  m_sendEvent = Simulator::ScheduleNow (&BackgroundLoadSender::SendBurst, this);
+}
+
+void
+BackgroundLoadSender::StopApplication ()
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  Simulator::Cancel (m_sendEvent);
+}
+
+uint64_t
+BackgroundLoadSender::BytesDue ()
+{
+  if (m_mode == OCCUPANCY)
+    {
+      // Whatever has been sent and not yet received is queued somewhere
+      // along the path, which in this topology means the eNB buffers
+      uint64_t rx = m_sink->GetTotalRx ();
+      if (rx > m_txBytes)
+        {
+          // Bytes written off as lost have made it after all
+          m_txBytes = rx;
+        }
+      if (rx != m_lastRx)
+        {
+          m_lastRx = rx;
+          m_lastProgress = Simulator::Now ();
+        }
+      else if (m_txBytes > rx && Simulator::Now () - m_lastProgress >= m_stallTimeout)
+        {
+          // Nothing is draining, so the outstanding bytes have been dropped
+          // (e.g. sent before the bearer was up, or RLC buffer overflow):
+          // forget them, otherwise the sender would stay silent for good
+          NS_LOG_WARN ("Sink stalled for " << Simulator::Now () - m_lastProgress << ", "
+                                            << m_txBytes - rx << " bytes considered lost");
+          m_txBytes = rx;
+          m_lastProgress = Simulator::Now ();
+        }
+
+      uint64_t outstanding = m_txBytes - rx;
+      return outstanding < m_target ? m_target - outstanding : 0;
+    }
+
+  // Rate and Poisson carry the fractional byte over to the next burst so
+  // that the long term average matches DataRate exactly
+  m_residual += m_rate.GetBitRate () / 8.0 * m_interval.GetSeconds ();
+  uint64_t due = std::floor (m_residual);
+  m_residual -= due;
+  return due;
+}
+
+void
+BackgroundLoadSender::SendBurst ()
+{
+  auto due = BytesDue ();
+
+  NS_LOG_INFO ("Sending " << due << " bytes burst at " << Simulator::Now () << " to "
+                          << m_destAddr);
+
+  while (due > 0)
+    {
+      uint32_t size = due < m_pktSize ? due : m_pktSize;
+      Ptr<Packet> packet = Create<Packet> (size);
+
+      if ((m_socket->Send (packet)) >= 0)
+        {
+          m_txBytes += size;
+        }
+      else
+        {
+          NS_LOG_INFO ("Error while sending");
+        }
+
+      // Report the event to the trace.
+      m_txTrace (packet);
+
+      due -= size;
+    }
+
+  ScheduleNextBurst ();
+}
+
+void
+BackgroundLoadSender::ScheduleNextBurst ()
+{
+  Time gap = m_interval;
+
+  if (m_mode == POISSON)
+    {
+      gap = Seconds (m_burstGap->GetValue ());
+    }
+
+  m_sendEvent = Simulator::Schedule (gap, &BackgroundLoadSender::SendBurst, this);
+}
@@ -0,0 +1,79 @@
+#ifndef BACKGROUND_LOAD_H
+#define BACKGROUND_LOAD_H
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/application.h"
+#include "ns3/packet-sink.h"
+
+using namespace ns3;
+
+//------------------------------------------------------
+// BackgroundLoadSender
+//------------------------------------------------------
+// UDP replacement for the packet-level greedy TCP flow.  The sender wakes up
+// once per burst and pushes all the bytes due in that burst at once, still
+// as PacketSize packets, each one going through the whole EPC/LTE stack:
+// only TCP, its ACKs and their uplink scheduling are saved.
+//
+// Modes:
+// - Rate: constant arrival process at DataRate, one burst every Interval
+// - Poisson: bursts of DataRate * Interval bytes with exponentially
+//   distributed inter-arrival times of mean Interval
+// - Occupancy: every Interval, top up the bytes outstanding between this
+//   sender and the sink (see SetSink) to TargetOccupancy.  If the sink
+//   stops receiving for StallTimeout while bytes are outstanding, these are
+//   considered lost and the count restarts from what the sink has received.
+//   Losses while the sink keeps receiving go unnoticed, and lower the
+//   actual occupancy accordingly.
+class BackgroundLoadSender : public Application
+{
+public:
+  enum Mode
+  {
+    RATE,
+    POISSON,
+    OCCUPANCY
+  };
+
+  static TypeId GetTypeId (void);
+  BackgroundLoadSender ();
+  virtual ~BackgroundLoadSender ();
+
+  // Receiving end, used as feedback in Occupancy mode
+  void SetSink (Ptr<PacketSink> sink);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  virtual void StartApplication (void);
+  virtual void StopApplication (void);
+
+  void SendBurst ();
+  uint64_t BytesDue ();
+  void ScheduleNextBurst ();
+
+  Mode m_mode;
+  uint32_t m_pktSize;
+  Ipv4Address m_destAddr;
+  uint32_t m_destPort;
+  DataRate m_rate;
+  Time m_interval;
+  uint32_t m_target;
+  Time m_stallTimeout;
+
+  Ptr<Socket> m_socket;
+  Ptr<PacketSink> m_sink;
+  Ptr<ExponentialRandomVariable> m_burstGap;
+  EventId m_sendEvent;
+
+  TracedCallback<Ptr<const Packet>> m_txTrace;
+
+  uint64_t m_txBytes;
+  uint64_t m_lastRx;
+  Time m_lastProgress;
+  double m_residual;
+};
+
+#endif  // BACKGROUND_LOAD_H
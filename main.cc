@@ -1,5 +1,7 @@
 // See README.md
 
+#include <chrono>
+
 #include "ns3/applications-module.h"
 #include "ns3/config-store.h"
 #include "ns3/core-module.h"
@@ -13,6 +15,7 @@
 #include "ns3/nstime.h"
 #include "ns3/point-to-point-helper.h"
 #include "realtime-apps.h"
+#include "background-load.h"
 
 using namespace ns3;
 
@@ -27,6 +30,8 @@ main (int argc, char *argv[])
 {
   bool markingEnabled = true;
   bool videoExperiment = false;
+  std::string background ("greedy");
+  std::string config;
 
   std::string runId = "run-" + std::to_string (time (NULL));
   std::string experiment ("loss latency tradeoff");
@@ -43,6 +48,14 @@ main (int argc, char *argv[])
                 markingEnabled);
   cmd.AddValue ("video", "Whether we do an audio(def) or a video experiment.",
                 videoExperiment);
+  cmd.AddValue ("background",
+                "Downlink pipe filler: greedy (packet-level TCP, def) or the aggregate "
+                "BackgroundLoadSender in one of its modes: rate, poisson, occupancy.",
+                background);
+  cmd.AddValue ("config",
+                "label of the sweep point this trial belongs to, recorded as metadata "
+                "together with the swept parameters (see aggregate-runs)",
+                config);
   cmd.Parse (argc, argv);
 
   // Configure FDD SISO (transmission mode 0) with 6 RBs, i.e. a peak downlink
@@ -212,6 +225,15 @@ main (int argc, char *argv[])
   data.DescribeRun (experiment, strategy, input, runId);
   // Add any information we wish to record about this run.
   data.AddMetadata ("LLT", uint32_t (markingEnabled));
+  data.AddMetadata ("background", background);
+  data.AddMetadata ("video", uint32_t (videoExperiment));
+  // replication, i.e. not part of the configuration (see aggregate-runs)
+  data.AddMetadata ("RngRun", uint32_t (RngSeedManager::GetRun ()));
+  // everything else is part of the configuration, swept parameters included
+  data.AddMetadata ("config", config);
+  StringValue s1uRate;
+  epcHelper->GetAttribute ("S1uLinkDataRate", s1uRate);
+  data.AddMetadata ("S1uLinkDataRate", s1uRate.Get ());
   // use millisec granularity (See RealtimeReceiver classe)
   auto rtAppDelayStat = CreateObject<MinMaxAvgTotalCalculator<int64_t>> ();
   rtAppDelayStat->SetKey ("real time app delay (ms)");
@@ -224,20 +246,87 @@ main (int argc, char *argv[])
   receiver->SetJitterTracker (rtAppJitterStat);
   data.AddDataCalculator (rtAppJitterStat);
 
+  // Per-run histograms (1ms bins) so that percentiles can be computed across
+  // replications by merging bin counts
+  auto rtAppDelayHist = CreateObject<HistogramCalculator> ();
+  rtAppDelayHist->SetKey ("real time app delay (ms)");
+  receiver->SetDelayHistogram (rtAppDelayHist);
+  data.AddDataCalculator (rtAppDelayHist);
+
+  auto rtAppJitterHist = CreateObject<HistogramCalculator> ();
+  rtAppJitterHist->SetKey ("real time app jitter (ms)");
+  receiver->SetJitterHistogram (rtAppJitterHist);
+  data.AddDataCalculator (rtAppJitterHist);
+
+  // Cost of the run, to compare the background load models (see
+  // compare-background)
+  auto simEventsStat = CreateObject<MinMaxAvgTotalCalculator<double>> ();
+  simEventsStat->SetKey ("simulator events");
+  data.AddDataCalculator (simEventsStat);
+
+  auto wallClockStat = CreateObject<MinMaxAvgTotalCalculator<double>> ();
+  wallClockStat->SetKey ("wall clock (s)");
+  data.AddDataCalculator (wallClockStat);
+
   // Downlink pipe filler, no marking whatsoever
   uint16_t dlGreedyPort = 5687;
-  BulkSendHelper greedySender ("ns3::TcpSocketFactory",
-                               InetSocketAddress (UEIpIface.GetAddress (0), dlGreedyPort));
-  // MaxBytes==0 means send as much as possible until stopped
-  greedySender.SetAttribute ("MaxBytes", UintegerValue (0));
-  greedySender.SetAttribute ("SendSize", UintegerValue (1400));
-  auto greedySenderApp = greedySender.Install (appServer.Get (0));
-  greedySenderApp.Start (Seconds (0.02));
-
-  PacketSinkHelper greedyReceiver ("ns3::TcpSocketFactory",
+  if (background == "greedy")
+    {
+      BulkSendHelper greedySender ("ns3::TcpSocketFactory",
+                                   InetSocketAddress (UEIpIface.GetAddress (0), dlGreedyPort));
+      // MaxBytes==0 means send as much as possible until stopped
+      greedySender.SetAttribute ("MaxBytes", UintegerValue (0));
+      greedySender.SetAttribute ("SendSize", UintegerValue (1400));
+      auto greedySenderApp = greedySender.Install (appServer.Get (0));
+      greedySenderApp.Start (Seconds (0.02));
+
+      PacketSinkHelper greedyReceiver ("ns3::TcpSocketFactory",
+                                       InetSocketAddress (Ipv4Address::GetAny (), dlGreedyPort));
+      auto greedyReceiverApp = greedyReceiver.Install (UE.Get (0));
+      greedyReceiverApp.Start (Seconds (0.01));
+    }
+  else
+    {
+      // UDP load on the same default bearer: no TCP ACKs on the uplink,
+      // packets still go through the whole stack (speedup not measured yet,
+      // see compare-background)
+      PacketSinkHelper bgReceiver ("ns3::UdpSocketFactory",
                                    InetSocketAddress (Ipv4Address::GetAny (), dlGreedyPort));
-  auto greedyReceiverApp = greedyReceiver.Install (UE.Get (0));
-  greedyReceiverApp.Start (Seconds (0.01));
+      auto bgReceiverApp = bgReceiver.Install (UE.Get (0));
+      bgReceiverApp.Start (Seconds (0.01));
+
+      // Rate, interval and target occupancy can be tuned from the command
+      // line, e.g. --BackgroundLoadSender::TargetOccupancy=6000
+      auto bgSender = CreateObject<BackgroundLoadSender> ();
+      appServer.Get (0)->AddApplication (bgSender);
+      bgSender->SetAttribute ("Destination", Ipv4AddressValue (UEIpIface.GetAddress (0)));
+      bgSender->SetAttribute ("Port", UintegerValue (dlGreedyPort));
+      if (background == "rate")
+        {
+          bgSender->SetAttribute ("Mode", EnumValue (BackgroundLoadSender::RATE));
+        }
+      else if (background == "poisson")
+        {
+          bgSender->SetAttribute ("Mode", EnumValue (BackgroundLoadSender::POISSON));
+        }
+      else if (background == "occupancy")
+        {
+          bgSender->SetAttribute ("Mode", EnumValue (BackgroundLoadSender::OCCUPANCY));
+        }
+      else
+        {
+          NS_FATAL_ERROR ("Unknown background load " << background);
+        }
+      bgSender->SetSink (DynamicCast<PacketSink> (bgReceiverApp.Get (0)));
+      for (std::string attr :
+           {"DataRate", "Interval", "TargetOccupancy", "StallTimeout", "PacketSize"})
+        {
+          StringValue value;
+          bgSender->GetAttribute (attr, value);
+          data.AddMetadata ("BackgroundLoadSender::" + attr, value.Get ());
+        }
+      bgSender->SetStartTime (Seconds (0.02));
+    }
 
   // Dump PHY, MAC, RLC and PDCP level KPIs
   lteHelper->EnableTraces ();
@@ -251,7 +340,14 @@ main (int argc, char *argv[])
   Simulator::Stop (Seconds (5));
 
   // Run the simulation
+  auto wallClockStart = std::chrono::steady_clock::now ();
   Simulator::Run ();
+  std::chrono::duration<double> wallClock = std::chrono::steady_clock::now () - wallClockStart;
+
+  simEventsStat->Update (Simulator::GetEventCount ());
+  wallClockStat->Update (wallClock.count ());
+  NS_LOG_INFO ("Executed " << Simulator::GetEventCount () << " events (background: "
+                           << background << ")");
 
   //--------------------------------------------
   //-- Generate statistics output.
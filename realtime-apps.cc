@@ -148,7 +148,8 @@ RealtimeReceiver::GetTypeId (void)
   return tid;
 }
 
-RealtimeReceiver::RealtimeReceiver () : m_calc (nullptr), m_delay (nullptr)
+RealtimeReceiver::RealtimeReceiver ()
+    : m_calc (nullptr), m_delay (nullptr), m_delayHist (nullptr), m_jitterHist (nullptr)
 {
   NS_LOG_FUNCTION_NOARGS ();
 
@@ -219,6 +220,18 @@ RealtimeReceiver::SetJitterTracker (Ptr<MinMaxAvgTotalCalculator<int64_t>> jitte
   m_jitter = jitter;
 }
 
+void
+RealtimeReceiver::SetDelayHistogram (Ptr<HistogramCalculator> delay)
+{
+  m_delayHist = delay;
+}
+
+void
+RealtimeReceiver::SetJitterHistogram (Ptr<HistogramCalculator> jitter)
+{
+  m_jitterHist = jitter;
+}
+
 void
 RealtimeReceiver::Receive (Ptr<Socket> socket)
 {
@@ -245,6 +258,10 @@ RealtimeReceiver::Receive (Ptr<Socket> socket)
               NS_LOG_INFO ("Computed delay " << delay);
 
               m_delay->Update (delay.GetMilliSeconds());
+            }
+          if (m_delayHist != nullptr)
+            {
+              m_delayHist->Update (delay.GetMilliSeconds ());
             }
 		  if (m_jitter != nullptr)
 		  {
@@ -258,6 +275,10 @@ RealtimeReceiver::Receive (Ptr<Socket> socket)
 
 				  NS_LOG_INFO ("Computed jitter " << jitter);
 				  m_jitter->Update (abs(jitter.GetMilliSeconds()));
+				  if (m_jitterHist != nullptr)
+				  {
+					  m_jitterHist->Update (abs(jitter.GetMilliSeconds()));
+				  }
 			  }
 		  }
         }
@@ -269,6 +290,72 @@ RealtimeReceiver::Receive (Ptr<Socket> socket)
     }
 }
 
+//------------------------------------------------------
+//-- HistogramCalculator
+//------------------------------------------------------
+NS_OBJECT_ENSURE_REGISTERED (HistogramCalculator);
+
+TypeId
+HistogramCalculator::GetTypeId (void)
+{
+  static TypeId tid =
+      TypeId ("HistogramCalculator")
+          .SetParent<DataCalculator> ()
+          .AddConstructor<HistogramCalculator> ()
+          .AddAttribute ("BinWidth", "Width of the histogram bins.", IntegerValue (1),
+                         MakeIntegerAccessor (&HistogramCalculator::m_binWidth),
+                         MakeIntegerChecker<int64_t> (1));
+  return tid;
+}
+
+HistogramCalculator::HistogramCalculator ()
+{
+  NS_LOG_FUNCTION_NOARGS ();
+}
+
+HistogramCalculator::~HistogramCalculator ()
+{
+  NS_LOG_FUNCTION_NOARGS ();
+}
+
+void
+HistogramCalculator::DoDispose (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  m_bins.clear ();
+  DataCalculator::DoDispose ();
+}
+
+void
+HistogramCalculator::Update (int64_t value)
+{
+  if (!m_enabled)
+    {
+      return;
+    }
+
+  // floor division, so that negative values land in the right bin too
+  int64_t bin = value / m_binWidth;
+  if (value % m_binWidth != 0 && value < 0)
+    {
+      bin--;
+    }
+  m_bins[bin * m_binWidth]++;
+}
+
+void
+HistogramCalculator::Output (DataOutputCallback &callback) const
+{
+  callback.OutputSingleton (m_context, m_key + " binwidth", double (m_binWidth));
+
+  for (auto const &bin : m_bins)
+    {
+      callback.OutputSingleton (m_context, m_key + " bin " + std::to_string (bin.first),
+                                double (bin.second));
+    }
+}
+
 //------------------------------------------------------
 //-- TimestampTag
 //------------------------------------------------------
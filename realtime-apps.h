@@ -7,8 +7,35 @@
 
 #include "ns3/stats-module.h"
 
+#include <map>
+
 using namespace ns3;
 
+//------------------------------------------------------
+// HistogramCalculator
+//------------------------------------------------------
+// Sparse fixed-width histogram.  Only non-empty bins are written out, as
+// "<key> bin <lower bound>" scalars, so that histograms of different runs
+// can be merged by summing counts.
+class HistogramCalculator : public DataCalculator
+{
+public:
+  static TypeId GetTypeId (void);
+  HistogramCalculator ();
+  virtual ~HistogramCalculator ();
+
+  void Update (int64_t value);
+
+  virtual void Output (DataOutputCallback &callback) const;
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  int64_t m_binWidth;
+  std::map<int64_t, uint64_t> m_bins;
+};
+
 //------------------------------------------------------
 // RealtimeSender
 //------------------------------------------------------
@@ -56,6 +83,8 @@ public:
   void SetCounter (Ptr<CounterCalculator<>> calc);
   void SetDelayTracker (Ptr<MinMaxAvgTotalCalculator<int64_t>> delay);
   void SetJitterTracker (Ptr<MinMaxAvgTotalCalculator<int64_t>> jitter);
+  void SetDelayHistogram (Ptr<HistogramCalculator> delay);
+  void SetJitterHistogram (Ptr<HistogramCalculator> jitter);
 
 protected:
   virtual void DoDispose (void);
@@ -77,6 +106,9 @@ private:
   Time  last_delay;
 
   Ptr<MinMaxAvgTotalCalculator<int64_t>> m_jitter;
+
+  Ptr<HistogramCalculator> m_delayHist;
+  Ptr<HistogramCalculator> m_jitterHist;
 };
 
 //------------------------------------------------------
@@ -11,6 +11,10 @@ set -o pipefail
 # - EpcTft
 
 declare -r S1_BW=5Mbps
+# greedy (packet-level TCP baseline), rate, poisson or occupancy
+declare -r BACKGROUND=${BACKGROUND:-greedy}
+# number of replications (RngRun 1..RUNS) per configuration
+declare -r RUNS=${RUNS:-1}
 
 # $1: source
 # $2: destination
@@ -18,13 +22,15 @@ function save_results() {
   local d="$2"
   echo "saving test results to ${d}"
   mkdir -p ${d}
-  cp $1/*.{txt,pcap,sca} ${d}
+  cp $1/*.{txt,pcap} ${d}
+  # move, so that the next replication does not pick it up again
+  mv $1/*.sca ${d}
 }
 
 function main() {
   local base_from=$1 base_to=$2
 
-  zipname=`printf "%s-%s.zip" $(basename $(pwd)) $(date "+%Y%M%d-%H%m")`
+  zipname=`printf "%s-%s-%s.zip" $(basename $(pwd)) ${BACKGROUND} $(date "+%Y%M%d-%H%m")`
   rm -vf ${zipname}
   
   for video in "false" "true"
@@ -37,10 +43,13 @@ function main() {
 		  [ "$marking" == "true" ] && mtag="mark"
 		  [ "$marking" == "true" ] || mtag="nomark"
 
-		  local tag="llt-simple-marking-${vtag}-${mtag}"
-		  echo ">> Running ${vtag} trial with marking ${marking}"
-		  NS_LOG="LLTSimple" ../../waf --run "llt-simple --ns3::PointToPointEpcHelper::S1uLinkDataRate=$S1_BW --marking-enabled=${marking} --video=${video} --run=${tag}"
-		  save_results ${base_from} ${base_to}/${vtag}/${mtag}
+		  for run in $(seq 1 ${RUNS})
+		  do
+			  local tag="llt-simple-marking-${vtag}-${mtag}-${run}"
+			  echo ">> Running ${vtag} trial with marking ${marking} (run ${run}/${RUNS})"
+			  NS_LOG="LLTSimple" ../../waf --run "llt-simple --ns3::PointToPointEpcHelper::S1uLinkDataRate=$S1_BW --marking-enabled=${marking} --video=${video} --background=${BACKGROUND} --RngRun=${run} --run=${tag}"
+			  save_results ${base_from} ${base_to}/${vtag}/${mtag}/run-${run}
+		  done
 	  done
   done
   zip -9rD ${zipname} $2
@@ -0,0 +1,105 @@
+# -*- coding: utf-8 -*-
+"""Reading of the sca files written by OmnetDataOutput, shared by
+aggregate-runs and compare-background"""
+
+import io
+import os
+import re
+import sys
+import math
+from zipfile import ZipFile
+
+metricRe = re.compile(r'^real time app (\w+)')
+
+# metadata that tells replications apart rather than configurations
+IGNORE = 'RngRun,description'
+
+
+def percentile(bins, total, q):
+    """Lower bound of the bin holding the q-th percentile"""
+    rank = max(1, math.ceil(q / 100 * total))
+    cum = 0
+    for lower in sorted(bins):
+        cum += bins[lower]
+        if cum >= rank:
+            return lower
+    return float('nan')
+
+
+def sca_files(paths):
+    """Yield (name, text stream) for every sca file, one at a time"""
+    for path in paths:
+        if os.path.isdir(path):
+            for root, dirs, files in os.walk(path):
+                dirs.sort()
+                for f in sorted(files):
+                    if f.endswith('.sca'):
+                        name = os.path.join(root, f)
+                        with open(name, 'r') as stream:
+                            yield name, stream
+        else:
+            with ZipFile(path) as archive:
+                for member in archive.namelist():
+                    if member.endswith('.sca'):
+                        with archive.open(member, 'r') as raw:
+                            yield '{}:{}'.format(path, member), io.TextIOWrapper(raw)
+
+
+def metric_name(name):
+    m = metricRe.match(name)
+    return m.group(1) if m is not None else name
+
+
+def parse_sca(stream):
+    """Return run label, attributes, statistics and histograms of a run"""
+    label, attrs, stats, hists = None, dict(), dict(), dict()
+    fields = None
+    for line in stream:
+        line = line.strip()
+        if line.startswith('field ') and fields is not None:
+            _, field, value = line.split(' ', 2)
+            fields[field] = float(value)
+            continue
+        fields = None
+        if line.startswith('run '):
+            label = line[4:]
+        elif line.startswith('attr '):
+            rest = line[5:]
+            if rest.startswith('"'):
+                key, _, rest = rest[1:].partition('"')
+            else:
+                key, _, rest = rest.partition(' ')
+            attrs[key] = rest.strip().strip('"')
+        elif line.startswith('statistic '):
+            name = line.split(' ', 2)[2]
+            fields = stats.setdefault(metric_name(name), dict())
+        elif line.startswith('scalar '):
+            name, value = line.split(' ', 2)[2].rsplit(' ', 1)
+            key, sep, lower = name.rpartition(' bin ')
+            if sep:
+                hist = hists.setdefault(metric_name(key), {'width': 1.0, 'bins': dict()})
+                hist['bins'][float(lower)] = int(float(value))
+            elif name.endswith(' binwidth'):
+                hist = hists.setdefault(metric_name(name[:-9]), {'width': 1.0, 'bins': dict()})
+                hist['width'] = float(value)
+    return label, attrs, stats, hists
+
+
+def runs(paths, ignore):
+    """Yield (configuration key, statistics, histograms) for every run,
+    the key being the sorted metadata not in ignore.  Runs whose RngRun has
+    already been seen in the same configuration are skipped."""
+    seeds = dict()
+    for name, stream in sca_files(paths):
+        label, attrs, stats, hists = parse_sca(stream)
+        key = tuple(sorted((k, v) for k, v in attrs.items() if k not in ignore))
+        # the run label is the same across sweeps, the seed within the
+        # configuration is what identifies a replication
+        seed = attrs.get('RngRun')
+        if seed is not None:
+            if seed in seeds.setdefault(key, set()):
+                print('skipping {}: RngRun {} of run {} already aggregated'.format(name, seed, label),
+                      file=sys.stderr)
+                continue
+            seeds[key].add(seed)
+        yield key, stats, hists